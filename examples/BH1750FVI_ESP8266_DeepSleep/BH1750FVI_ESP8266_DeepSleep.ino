@@ -0,0 +1,151 @@
+/***************************************************************************************************/
+/* 
+   Example for ROHM BH1750FVI Ambient Light Sensor library
+
+   written by : enjoyneering
+   sourse code: https://github.com/enjoyneering/
+
+   ROHM BH1750FVI features:
+   - power supply voltage +2.4v..+3.6v, absolute maximum +4.5v
+   - maximum current 190uA, sleep current 1uA
+   - I2C bus speed 100KHz..400KHz, up to 2 sensors on the bus
+   - maximum sensitivity at 560nm, yellow-green light
+   - 50Hz/60Hz flicker reduction
+   - measurement accuracy +-20%
+   - optical filter compensation by changing sensitivity* 0.45..3.68
+   - calibration by changing the accuracy 0.96..1.44
+   - typical measurement range depends on resolution mode sensitivity & accuracy values:
+     - from 1..32767 to 1..65535 lux
+   - typical measurement interval depends on resolution mode & sensitivity:
+     - from 81..662 msec to 10..88 msec
+
+   This device uses I2C bus to communicate, specials pins are required to interface
+   Board                                     SDA              SCL              Level
+   Uno, Mini, Pro, ATmega168, ATmega328..... A4               A5               5v
+   Mega2560................................. 20               21               5v
+   Due, SAM3X8E............................. 20               21               3.3v
+   Leonardo, Micro, ATmega32U4.............. 2                3                5v
+   Digistump, Trinket, Gemma, ATtiny85...... PB0/D0           PB2/D2           3.3v/5v
+   Blue Pill*, STM32F103xxxx boards*........ PB9/PB7          PB8/PB6          3.3v/5v
+   ESP8266 ESP-01**......................... GPIO0            GPIO2            3.3v/5v
+   NodeMCU 1.0**, WeMos D1 Mini**........... GPIO4/D2         GPIO5/D1         3.3v/5v
+   ESP32***................................. GPIO21/D21       GPIO22/D22       3.3v
+                                             GPIO16/D16       GPIO17/D17       3.3v
+                                            *hardware I2C Wire mapped to Wire1 in stm32duino
+                                             see https://github.com/stm32duino/wiki/wiki/API#I2C
+                                           **most boards has 10K..12K pullup-up resistor
+                                             on GPIO0/D3, GPIO2/D4/LED & pullup-down on
+                                             GPIO15/D8 for flash & boot
+                                          ***hardware I2C Wire mapped to TwoWire(0) aka GPIO21/GPIO22 in Arduino ESP32
+
+   Supported frameworks:
+   Arduino Core - https://github.com/arduino/Arduino/tree/master/hardware
+   ATtiny  Core - https://github.com/SpenceKonde/ATTinyCore
+   ESP8266 Core - https://github.com/esp8266/Arduino
+   ESP32   Core - https://github.com/espressif/arduino-esp32
+   STM32   Core - https://github.com/stm32duino/Arduino_Core_STM32
+
+
+   GNU GPL license, all text above must be included in any redistribution,
+   see link for details - https://www.gnu.org/licenses/licenses.html
+*/
+/***************************************************************************************************/
+#include <Wire.h>
+#include <BH1750FVI.h>
+#include <ESP8266WiFi.h>
+
+#define RTC_STATE_OFFSET 0             //RTC user memory offset in 4-byte blocks, 0..127
+#define SLEEP_TIME_USEC  10000000      //deep sleep time, in usec
+
+BH1750FVI_STATE sensorState;
+
+
+/**************************************************************************/
+/*
+    BH1750FVI(address, resolution, sensitivity, accuracy)
+
+    NOTE:
+    - see "BH1750FVI_ESP8266_Demo" for details
+*/
+/**************************************************************************/
+BH1750FVI myBH1750(BH1750_DEFAULT_I2CADDR, BH1750_ONE_TIME_HIGH_RES_MODE, BH1750_SENSITIVITY_DEFAULT, BH1750_ACCURACY_DEFAULT);
+
+
+/**************************************************************************/
+/*
+    setup()
+
+    Main setup
+
+    NOTE:
+    - connect GPIO16/D0 to RST for wake-up from deep sleep
+
+    - RTC user memory keeps data during deep sleep & it is garbage
+      after power-on, "setState()" rejects invalid state & "begin()"
+      does full sensor initialization
+
+    - sensor must stay powered during deep sleep, MTreg is lost after
+      power loss
+*/
+/**************************************************************************/
+void setup()
+{
+  /* WiFi initialization */
+  WiFi.persistent(false);                                                                     //disable saving wifi config into SDK flash area
+  WiFi.forceSleepBegin();                                                                     //disable AP & station by calling "WiFi.mode(WIFI_OFF)" & put modem to sleep
+
+  /* Serial initialization */
+  Serial.begin(115200, SERIAL_8N1, SERIAL_TX_ONLY);
+  Serial.println();
+
+  /* restore BH1750 settings from RTC memory */
+  ESP.rtcUserMemoryRead(RTC_STATE_OFFSET, (uint32_t *)&sensorState, sizeof(sensorState));
+
+  if (myBH1750.setState(sensorState) == true) {Serial.println(F("warm start"));}              //see NOTE
+  else                                        {Serial.println(F("cold start"));}
+
+  /* BH1750 initialization */
+  if (myBH1750.begin() != true)                                                               //warm start also starts first measurement
+  {
+    Serial.println(F("ROHM BH1750FVI is not present"));                                       //(F()) saves string to flash & keeps dynamic memory free
+  }
+  else
+  {
+    float lightLevel = myBH1750.readLightLevel();                                             //waits only for the rest of integration time after warm start
+
+    Serial.print(F("Light level.........: "));
+    if (lightLevel != BH1750_ERROR)                                                           //BH1750_ERROR=4294967295
+    {
+      Serial.print(lightLevel, 2);
+      Serial.println(F(" lux"));
+    }
+    else
+    {
+      Serial.println(F("error"));
+    }
+
+    /* save BH1750 settings to RTC memory */
+    myBH1750.getState(sensorState);
+
+    ESP.rtcUserMemoryWrite(RTC_STATE_OFFSET, (uint32_t *)&sensorState, sizeof(sensorState));
+  }
+
+  Serial.println(F("sleep (^o^) ~zzzzzzzzz"));
+
+  ESP.deepSleep(SLEEP_TIME_USEC);                                                             //one time mode sensor is already in sleep after measurement, 1uA
+}
+
+
+/**************************************************************************/
+/*
+    loop()
+
+    Main loop
+
+    NOTE:
+    - never called, ESP8266 restarts from "setup()" after deep sleep
+*/
+/**************************************************************************/
+void loop()
+{
+}
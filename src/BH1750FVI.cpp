@@ -77,11 +77,14 @@
 
 BH1750FVI::BH1750FVI(BH1750FVI_ADDRESS addr, BH1750FVI_RESOLUTION res, float sensitivity, float accuracy)
 {
-  _sensorAddress    = addr;
-  _sensorResolution = res;
-  _sensitivity      = constrain(sensitivity, BH1750_SENSITIVITY_MIN, BH1750_SENSITIVITY_MAX); //sensitivity range 0.45..3.68
-  _accuracy         = constrain(accuracy, BH1750_ACCURACY_MIN, BH1750_ACCURACY_MAX);          //accuracy range 0.96..1.44
-  _contMeasurement  = false;                                                                  //false=continuous measurement not started yet
+  _sensorAddress      = addr;
+  _sensorResolution   = res;
+  _sensitivity        = constrain(sensitivity, BH1750_SENSITIVITY_MIN, BH1750_SENSITIVITY_MAX); //sensitivity range 0.45..3.68
+  _accuracy           = constrain(accuracy, BH1750_ACCURACY_MIN, BH1750_ACCURACY_MAX);          //accuracy range 0.96..1.44
+  _contMeasurement    = false;                                                                  //false=continuous measurement not started yet
+  _warmStart          = false;                                                                  //false=full sensor initialization by "begin()", see "setState()"
+  _measurementPending = false;                                                                  //false=no measurement started by "begin()"
+  _measurementStart   = 0;
 }
 
 
@@ -95,6 +98,12 @@ BH1750FVI::BH1750FVI(BH1750FVI_ADDRESS addr, BH1750FVI_RESOLUTION res, float sen
     - call this function before doing anything else!!!
     - speed in Hz, stretch in usec
 
+    - warm start, if valid state was restored by "setState()":
+      - skips connection check, MTreg update & power down
+      - starts first measurement right away, sensor ACK is used as
+        connection check
+      - "readLightLevel()" waits only for the rest of integration time
+
     - returned value by "Wire.endTransmission()":
       - 0 success
       - 1 data too long to fit in transmit data buffer
@@ -143,6 +152,18 @@ bool BH1750FVI::begin()
   Wire.begin();
 #endif
 
+  if (_warmStart == true)                                  //sensor still holds MTreg, see "setState()"
+  {
+    _warmStart = false;                                    //next call does full initialization, e.g. after sensor power loss
+
+    if (_startMeasurement() != true) {return false;}       //measurement instruction wakes up sensor, error=sensor didn't return ACK
+
+    _measurementStart   = millis();
+    _measurementPending = true;                            //true="readLightLevel()" collects result of this measurement
+
+    return true;
+  }
+
   Wire.beginTransmission(_sensorAddress);                  //safety check, make sure the sensor is connected
 
   if (Wire.endTransmission(true) != 0) {return false;}     //collision on I2C bus, error=sensor didn't return ACK
@@ -180,7 +201,8 @@ bool BH1750FVI::begin()
 /**************************************************************************/
 void BH1750FVI::setResolution(BH1750FVI_RESOLUTION res)
 {
-  _sensorResolution = res;
+  _sensorResolution   = res;
+  _measurementPending = false;                                                          //false=measurement started by "begin()" uses old resolution
 }
 
 
@@ -251,7 +273,8 @@ bool BH1750FVI::setSensitivity(float sensitivity)
   if (_write8(measurnentTimeHighBit) != true) {return false;}                           //collision on I2C bus, error=sensor didn't return ACK
   if (_write8(measurnentTimeLowBit)  != true) {return false;}                           //collision on I2C bus, error=sensor didn't return ACK
 
-  _sensitivity = sensitivity;                                                           //MTreg register update success -> update sensitivity value
+  _sensitivity        = sensitivity;                                                    //MTreg register update success -> update sensitivity value
+  _measurementPending = false;                                                          //false=measurement started by "begin()" uses old MTreg
 
   return true;
 }
@@ -294,43 +317,24 @@ float BH1750FVI::getSensitivity()
 /**************************************************************************/
 float BH1750FVI::readLightLevel()
 {
+  uint16_t measurementDelay = _getMeasurementDelay();
+
   /* send measurement instruction */
-  switch(_sensorResolution)                                                   //"switch-case" faster & has smaller footprint than "if-else", see Atmel AVR4027 Application Note
+  if (_measurementPending == true)                                            //true=measurement already started by warm "begin()"
   {
-    case BH1750_CONTINUOUS_HIGH_RES_MODE:
-    case BH1750_CONTINUOUS_HIGH_RES_MODE_2:
-    case BH1750_CONTINUOUS_LOW_RES_MODE:
-      if (_contMeasurement != true)                                           //false=continuous measurement not started yet
-      {
-        if   (_write8(_sensorResolution) == true) {_contMeasurement = true;}  //measurement result continuously updated, no need to call measurement instruction any more
-        else                                      {return BH1750_ERROR;}      //collision on I2C bus, error=sensor didn't return ACK
-      }
-      break;
+    uint32_t elapsedTime = millis() - _measurementStart;
 
-    case BH1750_ONE_TIME_HIGH_RES_MODE:
-    case BH1750_ONE_TIME_HIGH_RES_MODE_2:
-    case BH1750_ONE_TIME_LOW_RES_MODE:
-      if   (_write8(_sensorResolution) == true)   {_contMeasurement = false;}
-      else                                        {return BH1750_ERROR;}      //collision on I2C bus, error=sensor didn't return ACK
-      break;
+    measurementDelay    = (elapsedTime < measurementDelay) ? (measurementDelay - elapsedTime) : 0;
+    _measurementPending = false;
   }
-
-  /* set measurement delay */
-  switch(_sensorResolution)
+  else
   {
-    case BH1750_CONTINUOUS_HIGH_RES_MODE:
-    case BH1750_CONTINUOUS_HIGH_RES_MODE_2:
-    case BH1750_ONE_TIME_HIGH_RES_MODE:
-    case BH1750_ONE_TIME_HIGH_RES_MODE_2:
-      delay(_sensitivity * 180);                                              //integration time = (0.45..3.68) * 120..180msec -> 81msec/12Hz..662msec/2Hz (default 180msec/5Hz)
-      break;
-
-    case BH1750_CONTINUOUS_LOW_RES_MODE:
-    case BH1750_ONE_TIME_LOW_RES_MODE:
-      delay(_sensitivity * 24);                                               //integration time = (0.45..3.68) * 16..24msec -> 10msec/100Hz..88msec/11Hz (default 24msec/42Hz)
-      break;
+    if (_startMeasurement() != true) {return BH1750_ERROR;}                   //collision on I2C bus, error=sensor didn't return ACK
   }
 
+  /* wait for measurement result */
+  delay(measurementDelay);
+
   /* read measurement result */                                               //result arter power-up & reset 0x0000
   Wire.requestFrom(_sensorAddress, (uint8_t)2, (uint8_t)true);                //read 2-bytes to "wire.h" rxBuffer, true=send stop after transmission
 
@@ -377,7 +381,7 @@ float BH1750FVI::readLightLevel()
 /**************************************************************************/
 void BH1750FVI::powerDown()
 {
-  if (_write8(BH1750_POWER_DOWN) == true) {_contMeasurement = false;}
+  if (_write8(BH1750_POWER_DOWN) == true) {_contMeasurement = false; _measurementPending = false;}
 }
 
 
@@ -418,6 +422,8 @@ void BH1750FVI::reset()
 {
   _write8(BH1750_RESET);
 
+  _measurementPending = false;
+
   delayMicroseconds(1); //see NOTE
 }
 
@@ -463,6 +469,177 @@ float BH1750FVI::getCalibration()
 }
 
 
+/**************************************************************************/
+/*
+    getState()
+
+    Save driver state for warm start
+
+    NOTE:
+    - store state to RTC memory/EEPROM before deep sleep & restore it
+      by "setState()" on wake-up, see "begin()" for details
+*/
+/**************************************************************************/
+void BH1750FVI::getState(BH1750FVI_STATE &state)
+{
+  state.id          = BH1750_STATE_ID;
+  state.address     = _sensorAddress;
+  state.resolution  = _sensorResolution;
+  state.sensitivity = _sensitivity;
+  state.accuracy    = _accuracy;
+  state.crc         = _getStateCRC8(state);
+}
+
+
+/**************************************************************************/
+/*
+    setState()
+
+    Restore driver state saved by "getState()"
+
+    NOTE:
+    - call before "begin()"
+
+    - sensor must stay powered between "getState()" & "begin()", MTreg
+      is lost after power loss & set to default 69
+
+    - returns false & keeps current settings if state is invalid, e.g.
+      RTC memory/EEPROM garbage after power-on (id, CRC-8 & range checks)
+      or state of other sensor, "begin()" does full initialization in
+      this case
+*/
+/**************************************************************************/
+bool BH1750FVI::setState(const BH1750FVI_STATE &state)
+{
+  if (state.id      != BH1750_STATE_ID)       {return false;}
+  if (state.crc     != _getStateCRC8(state)) {return false;}                            //RTC memory/EEPROM garbage passed id check
+  if (state.address != _sensorAddress)       {return false;}                            //state of another sensor on the bus
+
+  switch (state.resolution)
+  {
+    case BH1750_CONTINUOUS_HIGH_RES_MODE:
+    case BH1750_CONTINUOUS_HIGH_RES_MODE_2:
+    case BH1750_CONTINUOUS_LOW_RES_MODE:
+    case BH1750_ONE_TIME_HIGH_RES_MODE:
+    case BH1750_ONE_TIME_HIGH_RES_MODE_2:
+    case BH1750_ONE_TIME_LOW_RES_MODE:
+      break;
+
+    default:
+      return false;
+  }
+
+  if (!(state.sensitivity >= (float)BH1750_SENSITIVITY_MIN && state.sensitivity <= (float)BH1750_SENSITIVITY_MAX)) {return false;} //"!(a && b)" also rejects NaN, "float" limits keep saved boundary values valid
+  if (!(state.accuracy    >= (float)BH1750_ACCURACY_MIN    && state.accuracy    <= (float)BH1750_ACCURACY_MAX))    {return false;}
+
+  _sensorResolution = (BH1750FVI_RESOLUTION)state.resolution;
+  _sensitivity      = state.sensitivity;
+  _accuracy         = state.accuracy;
+  _warmStart        = true;                                                             //true=sensor already holds MTreg, see "begin()"
+
+  return true;
+}
+
+
+/**************************************************************************/
+/*
+    _startMeasurement()
+
+    Send measurement instruction
+
+    NOTE:
+    - in continuous modes instruction is sent only once, measurement
+      result is continuously updated by the sensor
+*/
+/**************************************************************************/
+bool BH1750FVI::_startMeasurement()
+{
+  switch(_sensorResolution)                                                   //"switch-case" faster & has smaller footprint than "if-else", see Atmel AVR4027 Application Note
+  {
+    case BH1750_CONTINUOUS_HIGH_RES_MODE:
+    case BH1750_CONTINUOUS_HIGH_RES_MODE_2:
+    case BH1750_CONTINUOUS_LOW_RES_MODE:
+      if (_contMeasurement != true)                                           //false=continuous measurement not started yet
+      {
+        if   (_write8(_sensorResolution) == true) {_contMeasurement = true;}  //measurement result continuously updated, no need to call measurement instruction any more
+        else                                      {return false;}             //collision on I2C bus, error=sensor didn't return ACK
+      }
+      break;
+
+    case BH1750_ONE_TIME_HIGH_RES_MODE:
+    case BH1750_ONE_TIME_HIGH_RES_MODE_2:
+    case BH1750_ONE_TIME_LOW_RES_MODE:
+      if   (_write8(_sensorResolution) == true)   {_contMeasurement = false;}
+      else                                        {return false;}             //collision on I2C bus, error=sensor didn't return ACK
+      break;
+  }
+
+  return true;
+}
+
+
+/**************************************************************************/
+/*
+    _getMeasurementDelay()
+
+    Return measurement delay (integration time), in msec
+
+    NOTE:
+    - see "setSensitivity()" for details
+*/
+/**************************************************************************/
+uint16_t BH1750FVI::_getMeasurementDelay()
+{
+  switch(_sensorResolution)
+  {
+    case BH1750_CONTINUOUS_HIGH_RES_MODE:
+    case BH1750_CONTINUOUS_HIGH_RES_MODE_2:
+    case BH1750_ONE_TIME_HIGH_RES_MODE:
+    case BH1750_ONE_TIME_HIGH_RES_MODE_2:
+      return _sensitivity * 180;                                              //integration time = (0.45..3.68) * 120..180msec -> 81msec/12Hz..662msec/2Hz (default 180msec/5Hz)
+
+    case BH1750_CONTINUOUS_LOW_RES_MODE:
+    case BH1750_ONE_TIME_LOW_RES_MODE:
+      return _sensitivity * 24;                                               //integration time = (0.45..3.68) * 16..24msec -> 10msec/100Hz..88msec/11Hz (default 24msec/42Hz)
+
+    default:
+      return 0;                                                               //unknown resolution, no measurement delay
+  }
+}
+
+
+/**************************************************************************/
+/*
+    _getStateCRC8()
+
+    Calculate CRC-8 of saved driver state
+
+    NOTE:
+    - polynomial 0x31 (x^8 + x^5 + x^4 + 1), initialization 0xFF
+    - calculated over all fields before "crc", struct padding is skipped
+*/
+/**************************************************************************/
+uint8_t BH1750FVI::_getStateCRC8(const BH1750FVI_STATE &state)
+{
+  const uint8_t *data   = (const uint8_t *)&state;
+  uint8_t        length = offsetof(BH1750FVI_STATE, crc);
+  uint8_t        crc    = 0xFF;
+
+  while (length--)
+  {
+    crc ^= *data++;
+
+    for (uint8_t i = 0; i < 8; i++)
+    {
+      if   (crc & 0x80) {crc = (crc << 1) ^ 0x31;}
+      else              {crc = (crc << 1);}
+    }
+  }
+
+  return crc;
+}
+
+
 /**************************************************************************/
 /*
     Write 8-bits value over I2C
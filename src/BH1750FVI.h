@@ -72,6 +72,7 @@
 
 #include <Arduino.h>
 #include <Wire.h>
+#include <stddef.h>                             //for "offsetof()"
 
 #if defined (__AVR__)
 #include <avr/pgmspace.h>                       //for Arduino AVR PROGMEM support
@@ -104,6 +105,7 @@
 #define BH1750FVI_I2C_SPEED_HZ      100000      //sensor I2C speed 100KHz..400KHz, in Hz
 #define BH1750FVI_I2C_STRETCH_USEC  1000        //I2C stretch time, in usec
 #define BH1750_ERROR                0xFFFFFFFF  //returns 4294967295, if communication error is occurred
+#define BH1750_STATE_ID             0xB175      //marks saved driver state as valid, see "getState()"
 
 typedef enum : uint8_t
 {
@@ -124,6 +126,17 @@ typedef enum : uint8_t
 }   
 BH1750FVI_RESOLUTION;
 
+typedef struct
+{
+  uint16_t id;                                  //BH1750_STATE_ID, garbage in RTC memory/EEPROM after power loss
+  uint8_t  address;                             //device I2C address
+  uint8_t  resolution;                          //measurement mode & resolution register
+  float    sensitivity;                         //sensitivity value, MTreg already loaded into sensor
+  float    accuracy;                            //calibration value
+  uint8_t  crc;                                 //CRC-8 of all fields above, must be last
+}
+BH1750FVI_STATE;
+
 
 class BH1750FVI 
 {
@@ -153,16 +166,25 @@ class BH1750FVI
   void    reset();
   void    setCalibration(float accuracy);
   float   getCalibration();
+  void    getState(BH1750FVI_STATE &state);
+  bool    setState(const BH1750FVI_STATE &state);
 
  private:
   float _sensitivity;
   float _accuracy;
   bool  _contMeasurement;
+  bool  _warmStart;
+  bool  _measurementPending;
+
+  uint32_t _measurementStart;
 
   BH1750FVI_RESOLUTION _sensorResolution;
   BH1750FVI_ADDRESS    _sensorAddress;
 
-  bool _write8(uint8_t value);
+  bool     _write8(uint8_t value);
+  bool     _startMeasurement();
+  uint16_t _getMeasurementDelay();
+  uint8_t  _getStateCRC8(const BH1750FVI_STATE &state);
 };
 
 #endif